@@ -193,6 +193,10 @@ int main() {
     return -1;
   }
 
+  if (!cube_prog.set_uniform("model", glm::mat4(1.0f))) {
+    return -1;
+  }
+
   while (!glfwWindowShouldClose(window)) {
     processInput(window);
 
@@ -206,10 +210,6 @@ int main() {
 
     auto view = scene_camera.get_view_matrix();
 
-    if (!cube_prog.set_uniform("model", glm::mat4(1.0f))) {
-      return -1;
-    }
-
     if (!cube_prog.set_uniform("view", view)) {
       return -1;
     }
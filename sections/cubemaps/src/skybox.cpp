@@ -184,6 +184,10 @@ int main() {
     return -1;
   }
 
+  if (!cube_prog.set_uniform("model", glm::mat4(1.0f))) {
+    return -1;
+  }
+
   while (!glfwWindowShouldClose(window)) {
     processInput(window);
 
@@ -197,10 +201,6 @@ int main() {
 
     auto view = scene_camera.get_view_matrix();
 
-    if (!cube_prog.set_uniform("model", glm::mat4(1.0f))) {
-      return -1;
-    }
-
     if (!cube_prog.set_uniform("view", view)) {
       return -1;
     }
@@ -100,6 +100,11 @@ int main() {
     return -1;
   }
 
+  // the sampler names don't change between frames, so build them only once
+  std::map<opengl::texture::type, std::vector<std::string>>
+      texture_variable_names{
+          {opengl::texture::type::diffuse, {"texture_diffuse1"}}};
+
   while (!glfwWindowShouldClose(window)) {
     processInput(window);
 
@@ -123,11 +128,6 @@ int main() {
       return -1;
     }
 
-    std::map<opengl::texture::type, std::vector<std::string>>
-        texture_variable_names;
-    texture_variable_names[opengl::texture::type::diffuse] = {
-        "texture_diffuse1"};
-
     if (!nanosuit_model.draw(model_prog, texture_variable_names)) {
       return -1;
     }
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <string>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -260,6 +261,41 @@ int main() {
       glm::vec3(0.7f, 0.2f, 2.0f), glm::vec3(2.3f, -3.3f, -4.0f),
       glm::vec3(-4.0f, 2.0f, -12.0f), glm::vec3(0.0f, 0.0f, -3.0f)};
 
+  // the point lights don't move, so their uniforms only need to be set once
+  for (size_t i = 0; i < sizeof(pointLightPositions) / sizeof(glm::vec3);
+       i++) {
+    auto prefix = std::string("pointLights[") + std::to_string(i) + "].";
+    if (!container_prog.set_uniform(prefix + "position",
+                                    pointLightPositions[i])) {
+      return -1;
+    }
+
+    if (!container_prog.set_uniform(prefix + "constant", 1.0f)) {
+      return -1;
+    }
+    if (!container_prog.set_uniform(prefix + "linear", 0.09f)) {
+      return -1;
+    }
+    if (!container_prog.set_uniform(prefix + "quadratic", 0.032f)) {
+      return -1;
+    }
+
+    if (!container_prog.set_uniform(prefix + "ambient", 0.05f, 0.05f, 0.05f)) {
+      return -1;
+    }
+    // we configure the diffuse intensity slightly higher; the right lighting
+    // conditions differ with each lighting method and environment. each
+    // environment and lighting type requires some tweaking to get the best
+    // out of your environment.
+    if (!container_prog.set_uniform(prefix + "diffuse", 0.8f, 0.8f, 0.8f)) {
+      return -1;
+    }
+
+    if (!container_prog.set_uniform(prefix + "specular", 1.0f, 1.0f, 1.0f)) {
+      return -1;
+    }
+  }
+
   while (!glfwWindowShouldClose(window)) {
     processInput(window);
 
@@ -296,52 +332,6 @@ int main() {
       return -1;
     }
 
-    for (size_t i = 0; i < sizeof(pointLightPositions) / sizeof(glm::vec3);
-         i++) {
-      if (!container_prog.set_uniform(std::string("pointLights[") +
-                                          std::to_string(i) + "].position",
-                                      pointLightPositions[i])) {
-        return -1;
-      }
-
-      if (!container_prog.set_uniform(std::string("pointLights[") +
-                                          std::to_string(i) + "].constant",
-                                      1.0f)) {
-        return -1;
-      }
-      if (!container_prog.set_uniform(std::string("pointLights[") +
-                                          std::to_string(i) + "].linear",
-                                      0.09f)) {
-        return -1;
-      }
-      if (!container_prog.set_uniform(std::string("pointLights[") +
-                                          std::to_string(i) + "].quadratic",
-                                      0.032f)) {
-        return -1;
-      }
-
-      if (!container_prog.set_uniform(std::string("pointLights[") +
-                                          std::to_string(i) + "].ambient",
-                                      0.05f, 0.05f, 0.05f)) {
-        return -1;
-      }
-      // we configure the diffuse intensity slightly higher; the right lighting
-      // conditions differ with each lighting method and environment. each
-      // environment and lighting type requires some tweaking to get the best
-      // out of your environment.
-      if (!container_prog.set_uniform(std::string("pointLights[") +
-                                          std::to_string(i) + "].diffuse",
-                                      0.8f, 0.8f, 0.8f)) {
-        return -1;
-      }
-
-      if (!container_prog.set_uniform(std::string("pointLights[") +
-                                          std::to_string(i) + "].specular",
-                                      1.0f, 1.0f, 1.0f)) {
-        return -1;
-      }
-    }
-
     for (size_t i = 0; i < sizeof(cubePositions) / sizeof(glm::vec3); i++) {
       if (!cubeVAO.use()) {
         return -1;